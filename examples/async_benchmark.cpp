@@ -0,0 +1,86 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AsyncOnlineStatistics.h"
+
+// Measures how long producer threads spend in each call that hands a sample
+// to the statistics, comparing a mutex around OnlineStatistics2D::Insert()
+// with AsyncOnlineStatistics::Insert(). Latencies include the cost of reading
+// the clock twice, which is the same for both.
+
+typedef std::chrono::steady_clock Clock;
+
+static const int PRODUCERS = 4;
+static const int SAMPLES = 200000;
+
+void report(const std::string &name, std::vector<double> &latency) {
+    std::sort(latency.begin(), latency.end());
+    auto at = [&](double p) { return latency[(std::size_t) (p * (latency.size() - 1))]; };
+    std::cout << std::setw(24) << std::left << name << std::right << std::fixed << std::setprecision(0)
+              << " p50: " << std::setw(7) << at(0.50) << " ns"
+              << "  p99: " << std::setw(7) << at(0.99) << " ns"
+              << "  p99.9: " << std::setw(7) << at(0.999) << " ns"
+              << "  max: " << std::setw(9) << latency.back() << " ns\n";
+}
+
+template <typename InsertFunction>
+std::vector<double> run(InsertFunction insert) {
+    std::vector<std::vector<double>> per_thread(PRODUCERS, std::vector<double>(SAMPLES));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < PRODUCERS; ++t) {
+        threads.emplace_back([&, t]() {
+            auto &latency = per_thread[t];
+            for (int i = 0; i < SAMPLES; ++i) {
+                double x = (double) i;
+                double y = 2.0 * x + t;
+                auto start = Clock::now();
+                insert(x, y);
+                auto stop = Clock::now();
+                latency[i] = std::chrono::duration<double, std::nano>(stop - start).count();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    std::vector<double> all;
+    for (auto &latency : per_thread) {
+        all.insert(all.end(), latency.begin(), latency.end());
+    }
+    return all;
+}
+
+int main() {
+    std::cout << PRODUCERS << " producers x " << SAMPLES << " samples\n";
+
+    OnlineStatistics2D locked_stats;
+    std::mutex lock;
+    auto locked = run([&](double x, double y) {
+        std::lock_guard<std::mutex> guard(lock);
+        locked_stats.Insert(x, y);
+    });
+    report("mutex + Insert", locked);
+
+    const AsyncOnlineStatistics::Backpressure policies[] = {
+        AsyncOnlineStatistics::Block, AsyncOnlineStatistics::Count
+    };
+    const std::string names[] = { "async (Block)", "async (Count)" };
+    for (int p = 0; p < 2; ++p) {
+        AsyncOnlineStatistics async_stats(1 << 16, policies[p]);
+        auto latency = run([&](double x, double y) {
+            async_stats.Insert(x, y);
+        });
+        async_stats.Flush();
+        report(names[p], latency);
+        StatisticResult2D result;
+        int count = async_stats.Snapshot(result);
+        std::cout << "    accumulated " << count << " samples, dropped "
+                  << std::setprecision(0) << async_stats.Dropped() << "\n";
+    }
+    exit(0);
+}
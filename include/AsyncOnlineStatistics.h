@@ -0,0 +1,86 @@
+/*
+ * AsyncOnlineStatistics.h
+ *
+ * (c) 2024 by SoundThinking Inc.
+ * Robert Calhoun <rcalhoun@soundthinking.com>
+ *
+ * Wrapper that moves OnlineStatistics2D updates off of latency-critical
+ * threads. Producers push (x, y) samples into a bounded lock-free ring
+ * (Vyukov's MPMC queue design, used here with a single consumer), which costs
+ * one compare-and-swap and two stores. A background thread drains the ring in
+ * batches into an OnlineStatistics2D and, after each batch, publishes a
+ * snapshot of the results.
+ *
+ * Snapshots are double buffered behind a sequence counter, so Snapshot()
+ * never waits on the consumer thread. A reader only retries if the consumer
+ * publishes twice while it is copying, which is rare.
+ *
+ * When the ring is full, Insert() follows the backpressure policy set in the
+ * constructor: Block spins until space is free, Drop discards the sample, and
+ * Count discards the sample and increments Dropped(). Remove() always waits
+ * for space, since a dropped removal would leave its sample in the statistics
+ * for good. For a sliding window, only keep a sample in the window buffer if
+ * its Insert() returned true; removing a sample that was dropped corrupts the
+ * statistics the same way.
+ *
+ */
+
+#ifndef INC_SUPPORT_ASYNCONLINESTATISTICS_H_
+#define INC_SUPPORT_ASYNCONLINESTATISTICS_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "OnlineStatistics.h"
+
+class AsyncOnlineStatistics {
+public:
+    enum Backpressure { Block, Drop, Count };
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        double x;
+        double y;
+        bool remove;
+    };
+    // count followed by the seven StatisticResult2D fields
+    static const int SNAPSHOT_FIELDS = 8;
+    struct Buffer {
+        std::atomic<std::uint64_t> sequence;
+        std::atomic<double> fields[SNAPSHOT_FIELDS];
+    };
+
+    Backpressure policy;
+    std::size_t batch;
+    std::size_t mask;
+    std::vector<Cell> cells;
+    alignas(64) std::atomic<std::size_t> enqueue_pos;
+    alignas(64) std::atomic<std::size_t> dropped;
+    alignas(64) std::size_t dequeue_pos;
+    std::atomic<std::size_t> published_pos;
+    std::atomic<bool> stop;
+    OnlineStatistics2D stats;
+    Buffer buffers[2];
+    std::atomic<int> current;
+    std::thread consumer;
+
+    bool Push(double x_value, double y_value, bool remove);
+    std::size_t Drain(void);
+    void Publish(void);
+    void Run(void);
+public:
+    AsyncOnlineStatistics(std::size_t capacity = 4096, Backpressure policy = Block, std::size_t batch = 256);
+    virtual ~AsyncOnlineStatistics(void);
+    AsyncOnlineStatistics(const AsyncOnlineStatistics &) = delete;
+    AsyncOnlineStatistics &operator=(const AsyncOnlineStatistics &) = delete;
+    bool Insert(double x_value, double y_value);
+    bool Remove(double x_value, double y_value);
+    void Flush(void);
+    int Snapshot(StatisticResult2D &result);
+    double Dropped(void);
+    std::size_t Capacity(void);
+};
+
+#endif /* INC_SUPPORT_ASYNCONLINESTATISTICS_H_ */
@@ -0,0 +1,72 @@
+/*
+ * OnlineHistogram.h
+ *
+ * (c) 2024 by SoundThinking Inc.
+ * Robert Calhoun <rcalhoun@soundthinking.com>
+ *
+ * Fixed-bin histogram that can be updated online alongside OnlineStatistics1D.
+ * Like the Welford accumulators, values can be inserted and later removed, so
+ * the same buffer of the last n samples that drives a moving mean and variance
+ * can also drive a moving distribution.
+ *
+ * Bins are either evenly spaced between lower and upper, or evenly spaced in
+ * log(x) for data that spans several orders of magnitude. Bins are half-open,
+ * [edge_i, edge_i+1). Values below the lower edge (including NaN, and values
+ * <= 0 for log spacing) are counted as underflow; values at or above the upper
+ * edge are counted as overflow. Both count towards Count() and the CDF.
+ *
+ * Because the bins are fixed, the bin index is pure arithmetic rather than a
+ * search, and InsertBatch() computes indices for a block of values in a
+ * branch-free loop that the compiler can vectorize. For log spacing only that
+ * index step vectorizes; the log() of each value is still computed one at a
+ * time, since libm calls are not vectorized without -ffast-math.
+ *
+ * Histograms with identical binning built on separate threads can be
+ * combined with Merge().
+ *
+ */
+
+#ifndef INC_SUPPORT_ONLINEHISTOGRAM_H_
+#define INC_SUPPORT_ONLINEHISTOGRAM_H_
+
+#include <cstddef>
+#include <vector>
+
+class OnlineHistogram {
+public:
+    enum Spacing { Linear, Logarithmic };
+private:
+    Spacing spacing;
+    int bins;
+    double lower;
+    double upper;
+    double origin;  // lower edge in transformed (linear or log) space
+    double width;   // bin width in transformed space
+    double scale;   // 1.0 / width
+    double count;
+    // counts[0] is underflow, counts[1..bins] are the bins, counts[bins+1] is overflow
+    std::vector<double> counts;
+    double Transform(double value) const;
+    double Untransform(double t) const;
+    int Index(double value) const;
+    void IndexBatch(const double *values, int *index, std::size_t n) const;
+public:
+    OnlineHistogram(double lower, double upper, int bins, Spacing spacing = Linear);
+    virtual ~OnlineHistogram(void);
+    int Insert(double value);
+    int Remove(double value);
+    int InsertBatch(const double *values, std::size_t n);
+    int RemoveBatch(const double *values, std::size_t n);
+    int Merge(const OnlineHistogram &other);
+    double Count(void);
+    int Bins(void);
+    double BinCount(int bin);
+    double BinLower(int bin);
+    double BinUpper(int bin);
+    double Underflow(void);
+    double Overflow(void);
+    double CDF(double value);
+    double Quantile(double p);
+};
+
+#endif /* INC_SUPPORT_ONLINEHISTOGRAM_H_ */
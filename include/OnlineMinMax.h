@@ -0,0 +1,63 @@
+/*
+ * OnlineMinMax.h
+ *
+ * (c) 2024 by SoundThinking Inc.
+ * Robert Calhoun <rcalhoun@soundthinking.com>
+ *
+ * Minimum, maximum and range of a sliding window, to sit next to an
+ * OnlineStatistics1D that tracks the mean and variance of the same window.
+ * Unlike the Welford moments, extremes cannot be backed out when a sample
+ * leaves, so this class keeps the window itself in a preallocated ring along
+ * with two monotonic deques of candidate minima and maxima. Each sample
+ * enters and leaves each deque at most once, so updates are amortized O(1).
+ *
+ * Samples must be removed in the order they were inserted (first in, first
+ * out), which is what the usual deque-of-last-n pattern does. Remove() checks
+ * its value against the oldest sample and returns -1 without changing
+ * anything if they differ. A window of capacity n has room for n + 1
+ * samples, so the new sample can be inserted before the oldest is removed;
+ * Insert() returns -1 without changing anything once that is full, and so
+ * does InsertBatch() if the whole batch does not fit.
+ *
+ * NaN samples are counted rather than queued, since they cannot be ordered.
+ * While any NaN is in the window, Min(), Max() and Range() return NaN.
+ *
+ */
+
+#ifndef INC_SUPPORT_ONLINEMINMAX_H_
+#define INC_SUPPORT_ONLINEMINMAX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+class OnlineMinMax1D {
+private:
+    std::size_t capacity;
+    std::size_t mask;
+    // window samples, indexed by sequence number
+    std::vector<double> values;
+    std::uint64_t head;  // sequence number of the oldest sample
+    std::uint64_t tail;  // sequence number of the next sample
+    // monotonic deques of sequence numbers, stored as rings
+    std::vector<std::uint64_t> min_queue;
+    std::vector<std::uint64_t> max_queue;
+    std::uint64_t min_front, min_back;
+    std::uint64_t max_front, max_back;
+    std::uint64_t nans;  // NaN samples in the window
+    void Evict(std::size_t n);
+public:
+    OnlineMinMax1D(std::size_t capacity);
+    virtual ~OnlineMinMax1D(void);
+    int Insert(double value);
+    int Remove(double value);
+    int InsertBatch(const double *data, std::size_t n);
+    int RemoveBatch(std::size_t n);
+    double Count(void);
+    std::size_t Capacity(void);
+    double Min(void);
+    double Max(void);
+    double Range(void);
+};
+
+#endif /* INC_SUPPORT_ONLINEMINMAX_H_ */
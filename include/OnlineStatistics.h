@@ -32,6 +32,7 @@ public:
     virtual ~OnlineStatistics1D(void);
     int Insert(double value);
     int Remove(double value);
+    int Merge(const OnlineStatistics1D &other);
     double Count(void);
     double Mean(void);
     double Variance(void);
@@ -51,6 +52,7 @@ public:
     virtual ~OnlineStatistics2D(void);
     int Insert(double x_value, double y_value);
     int Remove(double x_value, double y_value);
+    int Merge(const OnlineStatistics2D &other);
     double Count(void);
     double MeanX(void);
     double MeanY(void);
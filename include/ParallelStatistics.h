@@ -0,0 +1,170 @@
+/*
+ * ParallelStatistics.h
+ *
+ * (c) 2024 by SoundThinking Inc.
+ * Robert Calhoun <rcalhoun@soundthinking.com>
+ *
+ * Computes StatisticResult1D / StatisticResult2D over an in-memory range using
+ * all cores, with results that are bitwise reproducible from run to run.
+ *
+ * The input is split into fixed-size blocks, each block is accumulated on its
+ * own with OnlineStatistics1D or OnlineStatistics2D, and the per-block
+ * results are merged pairwise in a fixed tree order. Which thread handles a
+ * block never affects the arithmetic, so for a given block size the answer
+ * does not depend on the execution policy or the number of threads.
+ *
+ * Ranges of doubles give a StatisticResult1D. Ranges whose elements are
+ * pairs or tuples of two values, e.g. std::views::zip(x, y), give a
+ * StatisticResult2D.
+ *
+ *   ComputeStatistics(std::execution::par_unseq, v.begin(), v.end());
+ *   ComputeStatistics(std::execution::par_unseq, std::views::zip(x, y));
+ *
+ * Overloads without a policy spread the blocks over std::thread workers that
+ * take the next unclaimed block from a shared counter, for toolchains where
+ * the parallel policies run serially or need a library that is not present.
+ *
+ * Unlike the accumulator classes this header requires C++20. With libstdc++
+ * the parallel policies are backed by TBB, which must be linked.
+ *
+ */
+
+#ifndef INC_SUPPORT_PARALLELSTATISTICS_H_
+#define INC_SUPPORT_PARALLELSTATISTICS_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <execution>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include "OnlineStatistics.h"
+
+// Changing the block size changes the rounding, so keep it fixed when
+// comparing against stored baselines.
+static const std::size_t STATISTICS_BLOCK_SIZE = 4096;
+
+// Implementation helpers; only ComputeStatistics() is meant to be called.
+namespace ParallelStatisticsDetail {
+
+template <typename T>
+concept ExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<T>>;
+
+template <typename It>
+concept PairIterator = requires {
+    requires std::tuple_size<std::remove_cvref_t<std::iter_reference_t<It>>>::value == 2;
+};
+
+template <typename It>
+using AccumulatorFor = std::conditional_t<PairIterator<It>, OnlineStatistics2D, OnlineStatistics1D>;
+
+inline StatisticResult1D MakeResult(OnlineStatistics1D &stats) {
+    StatisticResult1D result;
+    result.Mean = stats.Mean();
+    result.Variance = stats.Variance();
+    result.SampleVariance = stats.SampleVariance();
+    return result;
+}
+
+inline StatisticResult2D MakeResult(OnlineStatistics2D &stats) {
+    StatisticResult2D result;
+    result.MeanX = stats.MeanX();
+    result.VarianceX = stats.VarianceX();
+    result.SampleVarianceX = stats.SampleVarianceX();
+    result.MeanY = stats.MeanY();
+    result.VarianceY = stats.VarianceY();
+    result.SampleVarianceY = stats.SampleVarianceY();
+    result.Covariance = stats.CovarianceXY();
+    return result;
+}
+
+// Accumulates block b of [first, first + n) into stats.
+template <std::random_access_iterator It>
+void AccumulateBlock(It first, std::size_t n, std::size_t block, std::size_t b, AccumulatorFor<It> &stats) {
+    std::size_t start = b * block;
+    It end = first + std::min(start + block, n);
+    for (It it = first + start; it != end; ++it) {
+        if constexpr (PairIterator<It>) {
+            auto &&sample = *it;
+            stats.Insert(std::get<0>(sample), std::get<1>(sample));
+        } else {
+            stats.Insert(*it);
+        }
+    }
+}
+
+// Merges the per-block accumulators pairwise: 0+1, 2+3, ... then 0+2, 4+6, ...
+template <typename Accumulator>
+auto MergeBlocks(std::vector<Accumulator> &blocks) {
+    for (std::size_t stride = 1; stride < blocks.size(); stride *= 2) {
+        for (std::size_t i = 0; i + stride < blocks.size(); i += 2 * stride) {
+            blocks[i].Merge(blocks[i + stride]);
+        }
+    }
+    if (blocks.empty()) {
+        Accumulator empty;
+        return MakeResult(empty);
+    }
+    return MakeResult(blocks[0]);
+}
+
+} // namespace ParallelStatisticsDetail
+
+template <ParallelStatisticsDetail::ExecutionPolicy Policy, std::random_access_iterator It>
+auto ComputeStatistics(Policy &&policy, It first, It last, std::size_t block = STATISTICS_BLOCK_SIZE) {
+    block = block > 0 ? block : 1;
+    std::size_t n = (std::size_t) (last - first);
+    std::size_t count = (n + block - 1) / block;
+    std::vector<ParallelStatisticsDetail::AccumulatorFor<It>> blocks(count);
+    std::vector<std::size_t> index(count);
+    std::iota(index.begin(), index.end(), std::size_t(0));
+    std::for_each(std::forward<Policy>(policy), index.begin(), index.end(), [&](std::size_t b) {
+        ParallelStatisticsDetail::AccumulateBlock(first, n, block, b, blocks[b]);
+    });
+    return ParallelStatisticsDetail::MergeBlocks(blocks);
+}
+
+template <ParallelStatisticsDetail::ExecutionPolicy Policy, std::ranges::random_access_range Range>
+auto ComputeStatistics(Policy &&policy, Range &&range, std::size_t block = STATISTICS_BLOCK_SIZE) {
+    return ComputeStatistics(std::forward<Policy>(policy), std::ranges::begin(range), std::ranges::end(range), block);
+}
+
+// threads = 0 uses std::thread::hardware_concurrency().
+template <std::random_access_iterator It>
+auto ComputeStatistics(It first, It last, unsigned threads = 0, std::size_t block = STATISTICS_BLOCK_SIZE) {
+    block = block > 0 ? block : 1;
+    std::size_t n = (std::size_t) (last - first);
+    std::size_t count = (n + block - 1) / block;
+    std::vector<ParallelStatisticsDetail::AccumulatorFor<It>> blocks(count);
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    threads = (unsigned) std::min<std::size_t>(threads, count);
+    std::atomic<std::size_t> next(0);
+    auto worker = [&]() {
+        for (std::size_t b = next.fetch_add(1); b < count; b = next.fetch_add(1)) {
+            ParallelStatisticsDetail::AccumulateBlock(first, n, block, b, blocks[b]);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &w : workers) {
+        w.join();
+    }
+    return ParallelStatisticsDetail::MergeBlocks(blocks);
+}
+
+template <std::ranges::random_access_range Range>
+auto ComputeStatistics(Range &&range, unsigned threads = 0, std::size_t block = STATISTICS_BLOCK_SIZE) {
+    return ComputeStatistics(std::ranges::begin(range), std::ranges::end(range), threads, block);
+}
+
+#endif /* INC_SUPPORT_PARALLELSTATISTICS_H_ */
@@ -0,0 +1,197 @@
+/* AsyncOnlineStatistics.cpp
+**
+** (c) 2024 SoundThinking, Inc
+** Robert B. Calhoun <rcalhoun@shotspotter.com>
+**
+** SPDX short identifier: MIT
+*/
+
+#include "AsyncOnlineStatistics.h"
+#include <chrono>
+
+// number of empty polls the consumer yields through before it starts sleeping
+static const int IDLE_SPINS = 64;
+
+// ring size must be a power of two so positions can be masked
+static std::size_t RingSize(std::size_t capacity) {
+    std::size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    return size;
+}
+
+
+AsyncOnlineStatistics::AsyncOnlineStatistics(std::size_t capacity, Backpressure policy, std::size_t batch)
+    : cells(RingSize(capacity)) {
+    std::size_t size = cells.size();
+    this->policy = policy;
+    this->batch = batch > 0 ? batch : 1;
+    mask = size - 1;
+    for (std::size_t i = 0; i < size; ++i) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    enqueue_pos.store(0, std::memory_order_relaxed);
+    dropped.store(0, std::memory_order_relaxed);
+    dequeue_pos = 0;
+    published_pos.store(0, std::memory_order_relaxed);
+    stop.store(false, std::memory_order_relaxed);
+    for (auto &b : buffers) {
+        b.sequence.store(0, std::memory_order_relaxed);
+        for (auto &f : b.fields) {
+            f.store(0.0, std::memory_order_relaxed);
+        }
+    }
+    current.store(0, std::memory_order_relaxed);
+    Publish();
+    consumer = std::thread(&AsyncOnlineStatistics::Run, this);
+}
+
+// Drains whatever is still queued before the consumer exits.
+AsyncOnlineStatistics::~AsyncOnlineStatistics(void) {
+    stop.store(true, std::memory_order_release);
+    consumer.join();
+}
+
+bool AsyncOnlineStatistics::Push(double x_value, double y_value, bool remove) {
+    std::size_t pos = enqueue_pos.load(std::memory_order_relaxed);
+    Cell *cell;
+    for (;;) {
+        cell = &cells[pos & mask];
+        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+        std::intptr_t diff = (std::intptr_t) seq - (std::intptr_t) pos;
+        if (diff == 0) {
+            if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // ring is full; removals are never dropped
+            if (policy == Block || remove) {
+                std::this_thread::yield();
+                pos = enqueue_pos.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (policy == Count) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+            return false;
+        } else {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+        }
+    }
+    cell->x = x_value;
+    cell->y = y_value;
+    cell->remove = remove;
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+bool AsyncOnlineStatistics::Insert(double x_value, double y_value) {
+    return Push(x_value, y_value, false);
+}
+
+bool AsyncOnlineStatistics::Remove(double x_value, double y_value) {
+    return Push(x_value, y_value, true);
+}
+
+// Consumer side: applies up to batch queued samples, returns how many.
+std::size_t AsyncOnlineStatistics::Drain(void) {
+    std::size_t n = 0;
+    while (n < batch) {
+        Cell &cell = cells[dequeue_pos & mask];
+        if (cell.sequence.load(std::memory_order_acquire) != dequeue_pos + 1) {
+            break;
+        }
+        if (cell.remove) {
+            stats.Remove(cell.x, cell.y);
+        } else {
+            stats.Insert(cell.x, cell.y);
+        }
+        cell.sequence.store(dequeue_pos + mask + 1, std::memory_order_release);
+        ++dequeue_pos;
+        ++n;
+    }
+    return n;
+}
+
+// Writes the current results into the inactive buffer and then flips to it.
+// The buffer's sequence number is odd while it is being written.
+void AsyncOnlineStatistics::Publish(void) {
+    int next = 1 - current.load(std::memory_order_relaxed);
+    Buffer &b = buffers[next];
+    b.sequence.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    double values[SNAPSHOT_FIELDS] = {
+        stats.Count(),
+        stats.MeanX(), stats.VarianceX(), stats.SampleVarianceX(),
+        stats.MeanY(), stats.VarianceY(), stats.SampleVarianceY(),
+        stats.CovarianceXY()
+    };
+    for (int i = 0; i < SNAPSHOT_FIELDS; ++i) {
+        b.fields[i].store(values[i], std::memory_order_relaxed);
+    }
+    b.sequence.fetch_add(1, std::memory_order_release);
+    current.store(next, std::memory_order_release);
+    published_pos.store(dequeue_pos, std::memory_order_release);
+}
+
+void AsyncOnlineStatistics::Run(void) {
+    int idle = 0;
+    for (;;) {
+        bool stopping = stop.load(std::memory_order_acquire);
+        if (Drain() > 0) {
+            Publish();
+            idle = 0;
+            continue;
+        }
+        if (stopping) {
+            break;
+        }
+        if (++idle < IDLE_SPINS) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+}
+
+// Waits until every sample accepted before the call is reflected in Snapshot().
+void AsyncOnlineStatistics::Flush(void) {
+    std::size_t target = enqueue_pos.load(std::memory_order_acquire);
+    while (published_pos.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+}
+
+// Copies the most recent published results and returns the sample count.
+int AsyncOnlineStatistics::Snapshot(StatisticResult2D &result) {
+    double values[SNAPSHOT_FIELDS];
+    for (;;) {
+        Buffer &b = buffers[current.load(std::memory_order_acquire)];
+        std::uint64_t before = b.sequence.load(std::memory_order_acquire);
+        for (int i = 0; i < SNAPSHOT_FIELDS; ++i) {
+            values[i] = b.fields[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint64_t after = b.sequence.load(std::memory_order_relaxed);
+        if (before == after && (before & 1) == 0) {
+            break;
+        }
+    }
+    result.MeanX = values[1];
+    result.VarianceX = values[2];
+    result.SampleVarianceX = values[3];
+    result.MeanY = values[4];
+    result.VarianceY = values[5];
+    result.SampleVarianceY = values[6];
+    result.Covariance = values[7];
+    return (int) values[0];
+}
+
+double AsyncOnlineStatistics::Dropped(void) {
+    return (double) dropped.load(std::memory_order_relaxed);
+}
+
+std::size_t AsyncOnlineStatistics::Capacity(void) {
+    return mask + 1;
+}
@@ -0,0 +1,225 @@
+/* OnlineHistogram.cpp
+**
+** (c) 2024 SoundThinking, Inc
+** Robert B. Calhoun <rcalhoun@shotspotter.com>
+**
+** SPDX short identifier: MIT
+*/
+
+#include "OnlineHistogram.h"
+#include <math.h>
+#include <limits>
+#include <stdexcept>
+
+// values are binned in blocks of this size so the index computation
+// runs over a small stack buffer that the compiler can vectorize
+static const std::size_t BATCH_BLOCK = 256;
+
+
+OnlineHistogram::OnlineHistogram(double lower, double upper, int bins, Spacing spacing) {
+    if (bins < 1 || !(lower < upper)) {
+        throw std::invalid_argument("OnlineHistogram requires bins >= 1 and lower < upper");
+    }
+    if (spacing == Logarithmic && !(lower > 0.0)) {
+        throw std::invalid_argument("OnlineHistogram with log spacing requires lower > 0");
+    }
+    this->spacing = spacing;
+    this->bins = bins;
+    this->lower = lower;
+    this->upper = upper;
+    origin = Transform(lower);
+    width = (Transform(upper) - origin) / bins;
+    scale = 1.0 / width;
+    count = 0.0;
+    counts.assign(bins + 2, 0.0);
+}
+
+OnlineHistogram::~OnlineHistogram(void) {
+}
+
+double OnlineHistogram::Transform(double value) const {
+    return spacing == Logarithmic ? log(value) : value;
+}
+
+double OnlineHistogram::Untransform(double t) const {
+    return spacing == Logarithmic ? exp(t) : t;
+}
+
+// Returns the bin for value (t is value in transformed space), offset by one
+// so that underflow is 0 and overflow is bins + 1. Clamping first keeps the
+// truncation to int a floor; the bin is then corrected against the raw edges,
+// because rounding in (t - origin) * scale can push a value within an ulp of
+// lower or upper across it. The lower check comes last and is written so that
+// NaN falls to underflow.
+static inline int BinIndex(double value, double t, double origin, double scale,
+                           double lower, double upper, int bins) {
+    double f = (t - origin) * scale;
+    f = f >= 0.0 ? f : 0.0;
+    f = f <= bins ? f : (double) bins;
+    int bin = (int) f;
+    bin = value < upper ? (bin < bins ? bin : bins - 1) : bins;
+    bin = value >= lower ? bin : -1;
+    return bin + 1;
+}
+
+int OnlineHistogram::Index(double value) const {
+    return BinIndex(value, Transform(value), origin, scale, lower, upper, bins);
+}
+
+// Same arithmetic as Index(), kept in sync so that a value inserted with
+// InsertBatch() can be removed with Remove() and vice versa.
+void OnlineHistogram::IndexBatch(const double *values, int *index, std::size_t n) const {
+    double t[BATCH_BLOCK];
+    const double *src = values;
+    if (spacing == Logarithmic) {
+        // scalar: log() sets errno, so this loop does not vectorize
+        for (std::size_t i = 0; i < n; ++i) {
+            t[i] = log(values[i]);
+        }
+        src = t;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        index[i] = BinIndex(values[i], src[i], origin, scale, lower, upper, bins);
+    }
+}
+
+int OnlineHistogram::Insert(double value) {
+    ++count;
+    ++counts[Index(value)];
+    return (int) count;
+}
+
+int OnlineHistogram::Remove(double value) {
+    --count;
+    --counts[Index(value)];
+    return (int) count;
+}
+
+int OnlineHistogram::InsertBatch(const double *values, std::size_t n) {
+    int index[BATCH_BLOCK];
+    for (std::size_t start = 0; start < n; start += BATCH_BLOCK) {
+        std::size_t len = n - start < BATCH_BLOCK ? n - start : BATCH_BLOCK;
+        IndexBatch(values + start, index, len);
+        for (std::size_t i = 0; i < len; ++i) {
+            ++counts[index[i]];
+        }
+    }
+    count += (double) n;
+    return (int) count;
+}
+
+int OnlineHistogram::RemoveBatch(const double *values, std::size_t n) {
+    int index[BATCH_BLOCK];
+    for (std::size_t start = 0; start < n; start += BATCH_BLOCK) {
+        std::size_t len = n - start < BATCH_BLOCK ? n - start : BATCH_BLOCK;
+        IndexBatch(values + start, index, len);
+        for (std::size_t i = 0; i < len; ++i) {
+            --counts[index[i]];
+        }
+    }
+    count -= (double) n;
+    return (int) count;
+}
+
+// Returns the new count, or -1 if the other histogram has different binning.
+int OnlineHistogram::Merge(const OnlineHistogram &other) {
+    if (other.spacing != spacing || other.bins != bins ||
+        other.lower != lower || other.upper != upper) {
+        return -1;
+    }
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        counts[i] += other.counts[i];
+    }
+    count += other.count;
+    return (int) count;
+}
+
+double OnlineHistogram::Count(void) {
+    return count;
+}
+
+int OnlineHistogram::Bins(void) {
+    return bins;
+}
+
+double OnlineHistogram::BinCount(int bin) {
+    if (bin < 0 || bin >= bins) {
+        return std::numeric_limits<double>::quiet_NaN();
+    } else {
+        return counts[bin + 1];
+    }
+}
+
+double OnlineHistogram::BinLower(int bin) {
+    if (bin < 0 || bin >= bins) {
+        return std::numeric_limits<double>::quiet_NaN();
+    } else if (bin == 0) {
+        return lower;
+    } else {
+        return Untransform(origin + bin * width);
+    }
+}
+
+double OnlineHistogram::BinUpper(int bin) {
+    if (bin < 0 || bin >= bins) {
+        return std::numeric_limits<double>::quiet_NaN();
+    } else if (bin == bins - 1) {
+        return upper;
+    } else {
+        return Untransform(origin + (bin + 1) * width);
+    }
+}
+
+double OnlineHistogram::Underflow(void) {
+    return counts[0];
+}
+
+double OnlineHistogram::Overflow(void) {
+    return counts[bins + 1];
+}
+
+// Approximate fraction of values <= value. Values are assumed to be spread
+// uniformly (in transformed space) within each bin; underflow and overflow
+// are treated as point masses at the lower and upper edges.
+double OnlineHistogram::CDF(double value) {
+    if (count < 1 || isnan(value)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (value < lower) {
+        return 0.0;
+    }
+    if (value >= upper) {
+        return 1.0;
+    }
+    double pos = (Transform(value) - origin) * scale;
+    int bin = (int) pos;
+    bin = bin < bins ? bin : bins - 1;
+    double below = counts[0];
+    for (int i = 0; i < bin; ++i) {
+        below += counts[i + 1];
+    }
+    below += counts[bin + 1] * (pos - bin);
+    return below / count;
+}
+
+// Approximate inverse of CDF(); p must be in [0, 1].
+double OnlineHistogram::Quantile(double p) {
+    if (count < 1 || !(p >= 0.0 && p <= 1.0)) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    double target = p * count;
+    if (counts[0] > 0 && target <= counts[0]) {
+        return lower;
+    }
+    double cumulative = counts[0];
+    for (int i = 0; i < bins; ++i) {
+        double c = counts[i + 1];
+        if (c > 0 && cumulative + c >= target) {
+            double frac = (target - cumulative) / c;
+            frac = frac > 0.0 ? frac : 0.0;
+            return Untransform(origin + (i + frac) * width);
+        }
+        cumulative += c;
+    }
+    return upper;
+}
@@ -0,0 +1,134 @@
+/* OnlineMinMax.cpp
+**
+** (c) 2024 SoundThinking, Inc
+** Robert B. Calhoun <rcalhoun@shotspotter.com>
+**
+** SPDX short identifier: MIT
+*/
+
+#include "OnlineMinMax.h"
+#include <math.h>
+#include <limits>
+#include <stdexcept>
+
+
+OnlineMinMax1D::OnlineMinMax1D(std::size_t capacity) {
+    if (capacity < 1) {
+        throw std::invalid_argument("OnlineMinMax1D requires capacity >= 1");
+    }
+    // rings are a power of two so sequence numbers can be masked, with one
+    // extra slot so callers can insert before they remove
+    std::size_t size = 1;
+    while (size < capacity + 1) {
+        size <<= 1;
+    }
+    this->capacity = capacity;
+    mask = size - 1;
+    values.assign(size, 0.0);
+    min_queue.assign(size, 0);
+    max_queue.assign(size, 0);
+    head = tail = 0;
+    min_front = min_back = 0;
+    max_front = max_back = 0;
+    nans = 0;
+}
+
+OnlineMinMax1D::~OnlineMinMax1D(void) {
+}
+
+// Drops the n oldest samples; deque entries older than the new head go with them.
+void OnlineMinMax1D::Evict(std::size_t n) {
+    std::uint64_t count = tail - head;
+    std::uint64_t stop = head + (n < count ? n : count);
+    for (; head < stop; ++head) {
+        if (isnan(values[head & mask])) {
+            --nans;
+        }
+    }
+    while (min_front != min_back && min_queue[min_front & mask] < head) {
+        ++min_front;
+    }
+    while (max_front != max_back && max_queue[max_front & mask] < head) {
+        ++max_front;
+    }
+}
+
+// Returns the new count, or -1 if the window already holds capacity + 1 samples.
+int OnlineMinMax1D::Insert(double value) {
+    if (tail - head > capacity) {
+        return -1;
+    }
+    std::uint64_t seq = tail++;
+    values[seq & mask] = value;
+    if (isnan(value)) {
+        ++nans;
+        return (int) (tail - head);
+    }
+    // drop candidates that can no longer be the extreme while this sample is in the window
+    while (min_back != min_front && values[min_queue[(min_back - 1) & mask] & mask] >= value) {
+        --min_back;
+    }
+    min_queue[min_back++ & mask] = seq;
+    while (max_back != max_front && values[max_queue[(max_back - 1) & mask] & mask] <= value) {
+        --max_back;
+    }
+    max_queue[max_back++ & mask] = seq;
+    return (int) (tail - head);
+}
+
+// Returns the new count, or -1 if value is not the oldest sample in the window.
+int OnlineMinMax1D::Remove(double value) {
+    if (tail == head) {
+        return -1;
+    }
+    double oldest = values[head & mask];
+    if (oldest != value && !(isnan(oldest) && isnan(value))) {
+        return -1;
+    }
+    Evict(1);
+    return (int) (tail - head);
+}
+
+// Returns the new count, or -1 without inserting anything if the batch does not fit.
+int OnlineMinMax1D::InsertBatch(const double *data, std::size_t n) {
+    if (tail - head + n > capacity + 1) {
+        return -1;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        Insert(data[i]);
+    }
+    return (int) (tail - head);
+}
+
+int OnlineMinMax1D::RemoveBatch(std::size_t n) {
+    Evict(n);
+    return (int) (tail - head);
+}
+
+double OnlineMinMax1D::Count(void) {
+    return (double) (tail - head);
+}
+
+std::size_t OnlineMinMax1D::Capacity(void) {
+    return capacity;
+}
+
+double OnlineMinMax1D::Min(void) {
+    if (tail == head || nans > 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    } else {
+        return values[min_queue[min_front & mask] & mask];
+    }
+}
+
+double OnlineMinMax1D::Max(void) {
+    if (tail == head || nans > 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    } else {
+        return values[max_queue[max_front & mask] & mask];
+    }
+}
+
+double OnlineMinMax1D::Range(void) {
+    return Max() - Min();
+}
@@ -41,6 +41,20 @@ int OnlineStatistics1D::Remove(double value) {
     return (int) count;
 }
 
+// Combines two sets of samples using the pairwise update of Chan et al.,
+// described in the same Wikipedia article as the Welford algorithm.
+int OnlineStatistics1D::Merge(const OnlineStatistics1D &other) {
+    double total = count + other.count;
+    if (total < 1) {
+        return (int) count;
+    }
+    double delta = other.mean - mean;
+    mean += delta * other.count / total;
+    m2 += other.m2 + delta * delta * count * other.count / total;
+    count = total;
+    return (int) count;
+}
+
 double OnlineStatistics1D::Count(void) {
     return count;
 }
@@ -118,6 +132,23 @@ int OnlineStatistics2D::Remove(double x_value, double y_value) {
     return (int) count;
 }
 
+int OnlineStatistics2D::Merge(const OnlineStatistics2D &other) {
+    double total = count + other.count;
+    if (total < 1) {
+        return (int) count;
+    }
+    double deltax = other.x_mean - x_mean;
+    double deltay = other.y_mean - y_mean;
+    double weight = count * other.count / total;
+    x_mean += deltax * other.count / total;
+    y_mean += deltay * other.count / total;
+    m2x += other.m2x + deltax * deltax * weight;
+    m2y += other.m2y + deltay * deltay * weight;
+    mxy += other.mxy + deltax * deltay * weight;
+    count = total;
+    return (int) count;
+}
+
 double OnlineStatistics2D::Count(void) {
     return count;
 }
@@ -1,14 +1,23 @@
+#include <algorithm>
 #include <array>
+#include <cmath>
+#include <deque>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <string>
 #include <vector>
 #include <ranges>
+#include <thread>
 
 // uses catch2
 #include <catch2/catch_all.hpp>
 //#include <catch2/matchers/catch_matchers_floating_point.hpp>
 #include "OnlineStatistics.h"
+#include "OnlineHistogram.h"
+#include "AsyncOnlineStatistics.h"
+#include "OnlineMinMax.h"
+#include "ParallelStatistics.h"
 
 
 int Add( int a, int b ) {
@@ -411,4 +420,481 @@ TEST_CASE("add 31 points, remove 25", "[onlinestatics2d]") {
     CHECK_THAT(intercept, Catch::Matchers::WithinRel(1.0,1e-9));
 }
 
+/* OnlineHistogram */
 
+TEST_CASE("No data", "[onlinehistogram]") {
+    auto hist = OnlineHistogram(0.0, 10.0, 10);
+    REQUIRE(hist.Count() == 0.0);
+    REQUIRE(hist.Bins() == 10);
+    REQUIRE_THAT(hist.CDF(5.0), Catch::Matchers::IsNaN());
+    REQUIRE_THAT(hist.Quantile(0.5), Catch::Matchers::IsNaN());
+    REQUIRE_THAT(hist.BinCount(10), Catch::Matchers::IsNaN());
+}
+
+TEST_CASE("Linear bins", "[onlinehistogram]") {
+    auto hist = OnlineHistogram(0.0, 10.0, 10);
+    std::array<double, 8> list = {-1.0, 0.0, 0.5, 1.0, 4.99, 9.99, 10.0, 25.0};
+    for (auto& x : list) {
+        hist.Insert(x);
+    }
+    REQUIRE(hist.Count() == 8.0);
+    REQUIRE(hist.Underflow() == 1.0);
+    REQUIRE(hist.Overflow() == 2.0);
+    REQUIRE(hist.BinCount(0) == 2.0);
+    REQUIRE(hist.BinCount(1) == 1.0);
+    REQUIRE(hist.BinCount(4) == 1.0);
+    REQUIRE(hist.BinCount(9) == 1.0);
+    REQUIRE_THAT(hist.BinLower(4), Catch::Matchers::WithinRel(4.0));
+    REQUIRE_THAT(hist.BinUpper(4), Catch::Matchers::WithinRel(5.0));
+}
+
+TEST_CASE("values one ulp from the edges", "[onlinehistogram]") {
+    for (int bins : {1, 2, 3, 4, 8, 10}) {
+        for (double upper : {1.0, 10.0}) {
+            auto hist = OnlineHistogram(0.0, upper, bins);
+            std::array<double, 4> list = {
+                std::nextafter(0.0, -1.0), -1e-17, 0.0, std::nextafter(upper, 0.0)
+            };
+            hist.InsertBatch(list.data(), list.size());
+            hist.Insert(upper);
+            hist.Insert(std::nextafter(upper, 2.0 * upper));
+            REQUIRE(hist.Underflow() == 2.0);
+            // with one bin, 0.0 and the value just below upper share bin 0
+            REQUIRE(hist.BinCount(0) == (bins == 1 ? 2.0 : 1.0));
+            REQUIRE(hist.BinCount(bins - 1) == (bins == 1 ? 2.0 : 1.0));
+            REQUIRE(hist.Overflow() == 2.0);
+            hist.Remove(-1e-17);
+            hist.Remove(std::nextafter(upper, 0.0));
+            REQUIRE(hist.Underflow() == 1.0);
+            REQUIRE(hist.BinCount(bins - 1) == (bins == 1 ? 1.0 : 0.0));
+        }
+    }
+}
+
+TEST_CASE("Log bins", "[onlinehistogram]") {
+    auto hist = OnlineHistogram(1.0, 1000.0, 3, OnlineHistogram::Logarithmic);
+    std::array<double, 7> list = {0.0, -5.0, 1.0, 9.0, 50.0, 500.0, 2000.0};
+    for (auto& x : list) {
+        hist.Insert(x);
+    }
+    REQUIRE(hist.Underflow() == 2.0);
+    REQUIRE(hist.BinCount(0) == 2.0);
+    REQUIRE(hist.BinCount(1) == 1.0);
+    REQUIRE(hist.BinCount(2) == 1.0);
+    REQUIRE(hist.Overflow() == 1.0);
+    REQUIRE_THAT(hist.BinLower(1), Catch::Matchers::WithinRel(10.0));
+    REQUIRE_THAT(hist.BinUpper(1), Catch::Matchers::WithinRel(100.0));
+}
+
+TEST_CASE("removal", "[onlinehistogram]") {
+    auto hist = OnlineHistogram(0.0, 4.0, 4);
+    hist.Insert(0.5);
+    hist.Insert(1.5);
+    hist.Insert(1.7);
+    hist.Insert(3.5);
+    hist.Remove(1.5);
+    hist.Remove(0.5);
+    REQUIRE(hist.Count() == 2.0);
+    REQUIRE(hist.BinCount(0) == 0.0);
+    REQUIRE(hist.BinCount(1) == 1.0);
+    REQUIRE(hist.BinCount(3) == 1.0);
+}
+
+TEST_CASE("batch insert matches scalar insert", "[onlinehistogram]") {
+    std::vector<double> values;
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(0.013 * i * i - 3.0);
+    }
+    auto scalar = OnlineHistogram(0.0, 1000.0, 37);
+    auto batch = OnlineHistogram(0.0, 1000.0, 37);
+    for (auto& x : values) {
+        scalar.Insert(x);
+    }
+    batch.InsertBatch(values.data(), values.size());
+    REQUIRE(batch.Count() == scalar.Count());
+    REQUIRE(batch.Underflow() == scalar.Underflow());
+    REQUIRE(batch.Overflow() == scalar.Overflow());
+    for (int i = 0; i < 37; ++i) {
+        REQUIRE(batch.BinCount(i) == scalar.BinCount(i));
+    }
+    // a sliding window removes with the scalar call what went in as a batch
+    for (int i = 0; i < 500; ++i) {
+        batch.Remove(values[i]);
+    }
+    scalar.RemoveBatch(values.data(), 500);
+    for (int i = 0; i < 37; ++i) {
+        REQUIRE(batch.BinCount(i) == scalar.BinCount(i));
+    }
+}
+
+TEST_CASE("merge", "[onlinehistogram]") {
+    auto a = OnlineHistogram(0.0, 10.0, 5);
+    auto b = OnlineHistogram(0.0, 10.0, 5);
+    a.Insert(1.0);
+    a.Insert(3.0);
+    b.Insert(3.5);
+    b.Insert(12.0);
+    REQUIRE(a.Merge(b) == 4);
+    REQUIRE(a.BinCount(0) == 1.0);
+    REQUIRE(a.BinCount(1) == 2.0);
+    REQUIRE(a.Overflow() == 1.0);
+    auto c = OnlineHistogram(0.0, 10.0, 4);
+    REQUIRE(a.Merge(c) == -1);
+    REQUIRE(a.Count() == 4.0);
+}
+
+TEST_CASE("cdf and quantile", "[onlinehistogram]") {
+    auto hist = OnlineHistogram(0.0, 100.0, 100);
+    for (int i = 0; i < 100; ++i) {
+        hist.Insert(i + 0.5);
+    }
+    REQUIRE_THAT(hist.CDF(-1.0), Catch::Matchers::WithinAbs(0.0, 1e-12));
+    REQUIRE_THAT(hist.CDF(25.0), Catch::Matchers::WithinRel(0.25));
+    REQUIRE_THAT(hist.CDF(50.5), Catch::Matchers::WithinRel(0.505));
+    REQUIRE_THAT(hist.CDF(100.0), Catch::Matchers::WithinRel(1.0));
+    REQUIRE_THAT(hist.Quantile(0.5), Catch::Matchers::WithinRel(50.0));
+    REQUIRE_THAT(hist.Quantile(0.9), Catch::Matchers::WithinRel(90.0));
+    REQUIRE_THAT(hist.Quantile(1.5), Catch::Matchers::IsNaN());
+}
+
+TEST_CASE("cdf and quantile on log bins", "[onlinehistogram]") {
+    auto hist = OnlineHistogram(1.0, 1000.0, 3, OnlineHistogram::Logarithmic);
+    hist.Insert(2.0);
+    hist.Insert(20.0);
+    hist.Insert(200.0);
+    // one sample per decade, so the CDF is linear in log10(x)
+    REQUIRE_THAT(hist.CDF(0.5), Catch::Matchers::WithinAbs(0.0, 1e-12));
+    REQUIRE_THAT(hist.CDF(10.0), Catch::Matchers::WithinRel(1.0 / 3.0, 1e-12));
+    REQUIRE_THAT(hist.CDF(pow(10.0, 1.5)), Catch::Matchers::WithinRel(0.5, 1e-12));
+    REQUIRE_THAT(hist.CDF(1000.0), Catch::Matchers::WithinRel(1.0));
+    REQUIRE_THAT(hist.Quantile(1.0 / 3.0), Catch::Matchers::WithinRel(10.0, 1e-12));
+    REQUIRE_THAT(hist.Quantile(0.5), Catch::Matchers::WithinRel(pow(10.0, 1.5), 1e-12));
+    REQUIRE_THAT(hist.Quantile(1.0), Catch::Matchers::WithinRel(1000.0, 1e-12));
+}
+
+/* AsyncOnlineStatistics */
+
+TEST_CASE("No data published", "[asynconlinestatistics]") {
+    auto stats = AsyncOnlineStatistics(16);
+    StatisticResult2D result;
+    REQUIRE(stats.Snapshot(result) == 0);
+    REQUIRE_THAT(result.MeanX, Catch::Matchers::IsNaN());
+    REQUIRE_THAT(result.Covariance, Catch::Matchers::IsNaN());
+    REQUIRE(stats.Capacity() == 16);
+}
+
+TEST_CASE("matches synchronous statistics", "[asynconlinestatistics]") {
+    std::array<double, 6> xvals = { -1.0, -1.0, 0.0, 0.0, 1.0, 1.0 };
+    std::array<double, 6> yvals = { -1.0,  1.0, 0.0, 2.0, 1.0, 3.0 };
+    auto stats = AsyncOnlineStatistics(4);
+    for (int i = 0; i < 6; ++i) {
+        REQUIRE(stats.Insert(xvals[i], yvals[i]));
+    }
+    stats.Flush();
+    StatisticResult2D result;
+    REQUIRE(stats.Snapshot(result) == 6);
+    REQUIRE_THAT(result.MeanX, Catch::Matchers::WithinAbs(0.0,1e-12));
+    REQUIRE_THAT(result.MeanY, Catch::Matchers::WithinRel(1.0));
+    REQUIRE_THAT(result.VarianceX, Catch::Matchers::WithinRel(0.6666666666666666));
+    REQUIRE_THAT(result.SampleVarianceY, Catch::Matchers::WithinRel(2.0));
+    REQUIRE_THAT(result.Covariance, Catch::Matchers::WithinRel(0.6666666666666666));
+
+    stats.Remove(-1.0, -1.0);
+    stats.Remove(-1.0, 1.0);
+    stats.Flush();
+    REQUIRE(stats.Snapshot(result) == 4);
+    REQUIRE_THAT(result.MeanX, Catch::Matchers::WithinRel(0.5));
+    REQUIRE_THAT(result.MeanY, Catch::Matchers::WithinRel(1.5));
+}
+
+TEST_CASE("multiple producers", "[asynconlinestatistics]") {
+    const int producers = 4;
+    const int samples = 10000;
+    auto stats = AsyncOnlineStatistics(1024, AsyncOnlineStatistics::Block);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&stats]() {
+            for (int i = 0; i < samples; ++i) {
+                stats.Insert(i % 2, 2.0 * (i % 2));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stats.Flush();
+    StatisticResult2D result;
+    REQUIRE(stats.Snapshot(result) == producers * samples);
+    REQUIRE(stats.Dropped() == 0.0);
+    REQUIRE_THAT(result.MeanX, Catch::Matchers::WithinRel(0.5, 1e-9));
+    REQUIRE_THAT(result.VarianceX, Catch::Matchers::WithinRel(0.25, 1e-9));
+    REQUIRE_THAT(result.Covariance, Catch::Matchers::WithinRel(0.5, 1e-9));
+}
+
+TEST_CASE("counted drops", "[asynconlinestatistics]") {
+    const int producers = 4;
+    const int samples = 10000;
+    auto stats = AsyncOnlineStatistics(8, AsyncOnlineStatistics::Count);
+    std::vector<std::thread> threads;
+    std::atomic<int> accepted = 0;
+    for (int t = 0; t < producers; ++t) {
+        threads.emplace_back([&stats, &accepted]() {
+            for (int i = 0; i < samples; ++i) {
+                if (stats.Insert(1.0, 1.0)) {
+                    ++accepted;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    stats.Flush();
+    StatisticResult2D result;
+    REQUIRE(stats.Snapshot(result) == accepted);
+    REQUIRE(stats.Dropped() + accepted == producers * samples);
+}
+
+TEST_CASE("sliding window with counted drops", "[asynconlinestatistics]") {
+    const std::size_t n = 20;
+    auto stats = AsyncOnlineStatistics(4, AsyncOnlineStatistics::Count, 1);
+    std::deque<double> window;
+    for (int i = 0; i < 5000; ++i) {
+        double x = (i * 7919) % 1013;
+        // only samples that made it into the ring belong to the window
+        if (stats.Insert(x, 2.0 * x)) {
+            window.push_back(x);
+        }
+        if (window.size() > n) {
+            REQUIRE(stats.Remove(window.front(), 2.0 * window.front()));
+            window.pop_front();
+        }
+    }
+    stats.Flush();
+    auto expected = OnlineStatistics1D();
+    for (auto& x : window) {
+        expected.Insert(x);
+    }
+    StatisticResult2D result;
+    REQUIRE(stats.Snapshot(result) == (int) window.size());
+    REQUIRE_THAT(result.MeanX, Catch::Matchers::WithinRel(expected.Mean(), 1e-9));
+    REQUIRE_THAT(result.MeanY, Catch::Matchers::WithinRel(2.0 * expected.Mean(), 1e-9));
+    REQUIRE_THAT(result.VarianceX, Catch::Matchers::WithinRel(expected.Variance(), 1e-6));
+}
+
+/* OnlineMinMax1D */
+
+TEST_CASE("Empty window", "[onlineminmax1d]") {
+    auto window = OnlineMinMax1D(4);
+    REQUIRE_THAT(window.Min(), Catch::Matchers::IsNaN());
+    REQUIRE_THAT(window.Max(), Catch::Matchers::IsNaN());
+    REQUIRE_THAT(window.Range(), Catch::Matchers::IsNaN());
+    window.Insert(1.0);
+    window.Remove(1.0);
+    REQUIRE(window.Count() == 0.0);
+    REQUIRE_THAT(window.Min(), Catch::Matchers::IsNaN());
+}
+
+TEST_CASE("insert and remove", "[onlineminmax1d]") {
+    auto window = OnlineMinMax1D(8);
+    window.Insert(3.0);
+    window.Insert(1.0);
+    window.Insert(4.0);
+    window.Insert(1.0);
+    window.Insert(5.0);
+    REQUIRE(window.Min() == 1.0);
+    REQUIRE(window.Max() == 5.0);
+    REQUIRE(window.Range() == 4.0);
+    window.Remove(3.0);
+    window.Remove(1.0);
+    REQUIRE(window.Min() == 1.0);
+    window.Remove(4.0);
+    REQUIRE(window.Min() == 1.0);
+    window.Remove(1.0);
+    REQUIRE(window.Min() == 5.0);
+    REQUIRE(window.Max() == 5.0);
+    REQUIRE(window.Count() == 1.0);
+}
+
+TEST_CASE("full window rejects inserts", "[onlineminmax1d]") {
+    auto window = OnlineMinMax1D(3);
+    std::array<double, 5> list = {9.0, 2.0, 5.0, 6.0, 7.0};
+    // room for capacity + 1 samples; a batch that does not fit changes nothing
+    REQUIRE(window.InsertBatch(list.data(), list.size()) == -1);
+    REQUIRE(window.Count() == 0.0);
+    REQUIRE(window.InsertBatch(list.data(), 4) == 4);
+    REQUIRE(window.InsertBatch(list.data() + 4, 1) == -1);
+    REQUIRE(window.Insert(1.0) == -1);
+    REQUIRE(window.Count() == 4.0);
+    REQUIRE(window.Min() == 2.0);
+    REQUIRE(window.Max() == 9.0);
+    window.RemoveBatch(2);
+    REQUIRE(window.Min() == 5.0);
+    REQUIRE(window.Max() == 6.0);
+    window.RemoveBatch(5);
+    REQUIRE(window.Count() == 0.0);
+}
+
+TEST_CASE("remove checks oldest sample", "[onlineminmax1d]") {
+    auto window = OnlineMinMax1D(3);
+    REQUIRE(window.Remove(1.0) == -1);
+    window.Insert(1.0);
+    window.Insert(std::numeric_limits<double>::quiet_NaN());
+    REQUIRE(window.Remove(2.0) == -1);
+    REQUIRE(window.Count() == 2.0);
+    REQUIRE(window.Remove(1.0) == 1);
+    REQUIRE(window.Remove(std::numeric_limits<double>::quiet_NaN()) == 0);
+}
+
+TEST_CASE("NaN in the window", "[onlineminmax1d]") {
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    auto window = OnlineMinMax1D(3);
+    window.Insert(1.0);
+    window.Insert(nan);
+    window.Insert(0.0);
+    REQUIRE_THAT(window.Min(), Catch::Matchers::IsNaN());
+    REQUIRE_THAT(window.Max(), Catch::Matchers::IsNaN());
+    REQUIRE_THAT(window.Range(), Catch::Matchers::IsNaN());
+    // [NaN, 0, 9]
+    window.Insert(9.0);
+    REQUIRE(window.Remove(1.0) == 3);
+    REQUIRE_THAT(window.Min(), Catch::Matchers::IsNaN());
+    // [0, 9, 5] once the NaN has left
+    window.Insert(5.0);
+    REQUIRE(window.Remove(nan) == 3);
+    REQUIRE(window.Min() == 0.0);
+    REQUIRE(window.Max() == 9.0);
+    REQUIRE(window.Range() == 9.0);
+    window.Remove(0.0);
+    REQUIRE(window.Min() == 5.0);
+}
+
+TEST_CASE("insert then remove with capacity n", "[onlineminmax1d]") {
+    const std::size_t n = 3;
+    auto window = OnlineMinMax1D(n);
+    auto stats = OnlineStatistics1D();
+    std::deque<double> buffer;
+    std::array<double, 6> list = {1.0, 9.0, 2.0, 3.0, 0.5, 4.0};
+    for (auto& x : list) {
+        buffer.push_back(x);
+        REQUIRE(window.Insert(x) > 0);
+        stats.Insert(x);
+        if (buffer.size() > n) {
+            REQUIRE(window.Remove(buffer.front()) == (int) n);
+            stats.Remove(buffer.front());
+            buffer.pop_front();
+        }
+        REQUIRE(window.Count() == stats.Count());
+    }
+    REQUIRE(window.Min() == 0.5);
+    REQUIRE(window.Max() == 4.0);
+}
+
+TEST_CASE("sliding window matches rescan", "[onlineminmax1d]") {
+    const std::size_t n = 25;
+    auto window = OnlineMinMax1D(n);
+    auto stats = OnlineStatistics1D();
+    std::deque<double> buffer;
+    for (int i = 0; i < 1000; ++i) {
+        double x = (i * 7919) % 1013 - 500.0;
+        buffer.push_back(x);
+        window.Insert(x);
+        stats.Insert(x);
+        if (buffer.size() > n) {
+            window.Remove(buffer.front());
+            stats.Remove(buffer.front());
+            buffer.pop_front();
+        }
+        REQUIRE(window.Count() == stats.Count());
+        REQUIRE(window.Min() == *std::min_element(buffer.begin(), buffer.end()));
+        REQUIRE(window.Max() == *std::max_element(buffer.begin(), buffer.end()));
+    }
+}
+
+/* merge and ComputeStatistics */
+
+TEST_CASE("merge accumulators", "[onlinestatics1d]") {
+    std::array<double, 5> list = {1.0, 2.0, 3.0, 4.0, 5.0};
+    auto a = OnlineStatistics1D();
+    auto b = OnlineStatistics1D();
+    a.Insert(list[0]);
+    a.Insert(list[1]);
+    for (int i = 2; i < 5; ++i) {
+        b.Insert(list[i]);
+    }
+    REQUIRE(a.Merge(b) == 5);
+    REQUIRE_THAT(a.Mean(), Catch::Matchers::WithinRel(3.0));
+    REQUIRE_THAT(a.Variance(), Catch::Matchers::WithinRel(2.0));
+    auto empty = OnlineStatistics1D();
+    REQUIRE(empty.Merge(a) == 5);
+    REQUIRE_THAT(empty.SampleVariance(), Catch::Matchers::WithinRel(2.5));
+}
+
+TEST_CASE("merge partial results", "[onlinestatics2d]") {
+    std::array<double, 6> xvals = { -1.0, -1.0, 0.0, 0.0, 1.0, 1.0 };
+    std::array<double, 6> yvals = { -1.0,  1.0, 0.0, 2.0, 1.0, 3.0 };
+    auto a = OnlineStatistics2D();
+    auto b = OnlineStatistics2D();
+    for (int i = 0; i < 6; ++i) {
+        (i < 4 ? a : b).Insert(xvals[i], yvals[i]);
+    }
+    REQUIRE(a.Merge(b) == 6);
+    REQUIRE_THAT(a.MeanX(), Catch::Matchers::WithinAbs(0.0,1e-12));
+    REQUIRE_THAT(a.MeanY(), Catch::Matchers::WithinRel(1.0));
+    REQUIRE_THAT(a.VarianceY(), Catch::Matchers::WithinRel(1.6666666666666667));
+    REQUIRE_THAT(a.CovarianceXY(), Catch::Matchers::WithinRel(0.6666666666666666));
+}
+
+TEST_CASE("empty range", "[computestatistics]") {
+    std::vector<double> values;
+    auto result = ComputeStatistics(std::execution::par_unseq, values);
+    REQUIRE_THAT(result.Mean, Catch::Matchers::IsNaN());
+    REQUIRE_THAT(ComputeStatistics(values, 4).Variance, Catch::Matchers::IsNaN());
+}
+
+TEST_CASE("1d matches serial and is reproducible", "[computestatistics]") {
+    std::vector<double> values;
+    auto serial = OnlineStatistics1D();
+    for (int i = 0; i < 100000; ++i) {
+        double x = 1e6 + ((i * 7919) % 10007) * 0.001;
+        values.push_back(x);
+        serial.Insert(x);
+    }
+    auto result = ComputeStatistics(std::execution::par_unseq, values.begin(), values.end());
+    REQUIRE_THAT(result.Mean, Catch::Matchers::WithinRel(serial.Mean(), 1e-12));
+    REQUIRE_THAT(result.Variance, Catch::Matchers::WithinRel(serial.Variance(), 1e-9));
+    REQUIRE_THAT(result.SampleVariance, Catch::Matchers::WithinRel(serial.SampleVariance(), 1e-9));
+
+    // bitwise identical regardless of policy and thread count
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        auto threaded = ComputeStatistics(values, threads);
+        REQUIRE(threaded.Mean == result.Mean);
+        REQUIRE(threaded.Variance == result.Variance);
+    }
+    auto sequenced = ComputeStatistics(std::execution::seq, values);
+    REQUIRE(sequenced.Mean == result.Mean);
+    REQUIRE(sequenced.Variance == result.Variance);
+}
+
+TEST_CASE("2d zip range", "[computestatistics]") {
+    std::vector<double> xvals;
+    std::vector<double> yvals;
+    auto serial = OnlineStatistics2D();
+    for (int i = 0; i < 50000; ++i) {
+        double x = i * 0.01;
+        double y = 2.0 * x + 1.0 + ((i * 7919) % 101 - 50) * 0.001;
+        xvals.push_back(x);
+        yvals.push_back(y);
+        serial.Insert(x, y);
+    }
+    auto result = ComputeStatistics(std::execution::par_unseq, std::views::zip(xvals, yvals), 1000);
+    REQUIRE_THAT(result.MeanX, Catch::Matchers::WithinRel(serial.MeanX(), 1e-12));
+    REQUIRE_THAT(result.MeanY, Catch::Matchers::WithinRel(serial.MeanY(), 1e-12));
+    REQUIRE_THAT(result.VarianceX, Catch::Matchers::WithinRel(serial.VarianceX(), 1e-9));
+    REQUIRE_THAT(result.SampleVarianceY, Catch::Matchers::WithinRel(serial.SampleVarianceY(), 1e-9));
+    REQUIRE_THAT(result.Covariance, Catch::Matchers::WithinRel(serial.CovarianceXY(), 1e-9));
+
+    auto threaded = ComputeStatistics(std::views::zip(xvals, yvals), 3, 1000);
+    REQUIRE(threaded.MeanX == result.MeanX);
+    REQUIRE(threaded.Covariance == result.Covariance);
+}